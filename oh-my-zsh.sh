@@ -64,6 +64,25 @@ if [ -z "$ZSH_COMPDUMP" ]; then
   ZSH_COMPDUMP="${ZDOTDIR:-${HOME}}/.zcompdump-${SHORT_HOST}-${ZSH_VERSION}"
 fi
 
+# An out of date dump is still used, while it is rebuilt in the background
+# (see lib/completion.zsh); compinit only builds it here when there is none,
+# or when a background rebuild started a while ago never replaced it. The
+# dump is up to date while neither $fpath nor its directories changed since
+# it was built, which is recorded in a .sig file named after it in
+# $ZSH_CACHE_DIR.
+_omz_compinit() {
+  local REPLY
+  omz_cache_signature $fpath
+  if [[ -f $ZSH_COMPDUMP ]] && omz_cache_check $ZSH_CACHE_DIR/${ZSH_COMPDUMP:t}.sig "$REPLY"; then
+    compinit "$@" -C -d "${ZSH_COMPDUMP}"
+  elif _omz_compdump_overdue; then
+    compinit "$@" -d "${ZSH_COMPDUMP}" && omz_cache_write $ZSH_CACHE_DIR/${ZSH_COMPDUMP:t}.sig "$REPLY"
+  else
+    _omz_compdump_rebuild "$*" "$REPLY"
+    compinit "$@" -C -d "${ZSH_COMPDUMP}"
+  fi
+}
+
 if [[ $ZSH_DISABLE_COMPFIX != true ]]; then
   # If completion insecurities exist, warn the user without enabling completions.
   if ! compaudit &>/dev/null; then
@@ -71,11 +90,12 @@ if [[ $ZSH_DISABLE_COMPFIX != true ]]; then
     handle_completion_insecurities
   # Else, enable and cache completions to the desired file.
   else
-    compinit -d "${ZSH_COMPDUMP}"
+    _omz_compinit
   fi
 else
-  compinit -i -d "${ZSH_COMPDUMP}"
+  _omz_compinit -i
 fi
+unfunction _omz_compinit
 
 # Load all of the plugins that were defined in ~/.zshrc
 for plugin ($plugins); do
@@ -14,20 +14,30 @@ function _wd() {
   local -a commands
   local -a warp_points
 
-  warp_points=( "${(f)mapfile[$CONFIG]//$HOME/~}" )
-
   typeset -A points
-  while read -r line
-  do
-    arr=(${(s,:,)line})
-    name=${arr[1]}
-    target_path=${arr[2]}
+  if (( ${+functions[omz_dirdb_sync]} )); then
+    # warp points live in the shared directory database
+    local -a reply
+    omz_dirdb_marks wd
+    points=("${(@)reply}")
+    for name target_path in ${(kv)points}; do
+      warp_points+=("${name}:${target_path/#$HOME/~}")
+    done
+  else
+    warp_points=( "${(f)mapfile[$CONFIG]//$HOME/~}" )
+
+    while read -r line
+    do
+      arr=(${(s,:,)line})
+      name=${arr[1]}
+      target_path=${arr[2]}
 
-    # replace ~ from path to fix completion (#17)
-    target_path=${target_path/#\~/$HOME}
+      # replace ~ from path to fix completion (#17)
+      target_path=${target_path/#\~/$HOME}
 
-    points[$name]=$target_path
-  done < $CONFIG
+      points[$name]=$target_path
+    done < $CONFIG
+  fi
 
   commands=(
     'add:Adds the current working directory to your warp points'
@@ -179,8 +179,13 @@ wd_add()
         wd_exit_fail "Warp point cannot contain colons"
     elif [[ ${points[$point]} == "" ]] || $force
     then
-        wd_remove $point > /dev/null
-        printf "%q:%s\n" "${point}" "${PWD/#$HOME/~}" >> $WD_CONFIG
+        if [[ -n $WD_DIRDB ]]
+        then
+            omz_dirdb_mark wd "${point}" "${PWD}"
+        else
+            wd_remove $point > /dev/null
+            printf "%q:%s\n" "${point}" "${PWD/#$HOME/~}" >> $WD_CONFIG
+        fi
 
         wd_print_msg $WD_GREEN "Warp point added"
 
@@ -204,7 +209,11 @@ wd_remove()
     if [[ ${points[$point]} != "" ]]
     then
         local config_tmp=$WD_CONFIG.tmp
-        if sed -n "/^${point}:.*$/!p" $WD_CONFIG > $config_tmp && mv $config_tmp $WD_CONFIG
+        if [[ -n $WD_DIRDB ]]
+        then
+            omz_dirdb_unmark wd "${point}"
+            wd_print_msg $WD_GREEN "Warp point removed"
+        elif sed -n "/^${point}:.*$/!p" $WD_CONFIG > $config_tmp && mv $config_tmp $WD_CONFIG
         then
             wd_print_msg $WD_GREEN "Warp point removed"
         else
@@ -219,35 +228,25 @@ wd_list_all()
 {
     wd_print_msg $WD_BLUE "All warp points:"
 
-    entries=$(sed "s:${HOME}:~:g" $WD_CONFIG)
-
     max_warp_point_length=0
-    while IFS= read -r line
+    for key in ${(k)points}
     do
-        arr=(${(s,:,)line})
-        key=${arr[1]}
-
         length=${#key}
         if [[ length -gt max_warp_point_length ]]
         then
             max_warp_point_length=$length
         fi
-    done <<< $entries
+    done
 
-    while IFS= read -r line
+    for key in ${(ko)points}
     do
-        if [[ $line != "" ]]
-        then
-            arr=(${(s,:,)line})
-            key=${arr[1]}
-            val=${arr[2]}
+        val="${points[$key]/#$HOME/~}"
 
-            if [[ -z $wd_quiet_mode ]]
-            then
-                printf "%${max_warp_point_length}s  ->  %s\n" $key $val
-            fi
+        if [[ -z $wd_quiet_mode ]]
+        then
+            printf "%${max_warp_point_length}s  ->  %s\n" $key $val
         fi
-    done <<< $entries
+    done
 }
 
 wd_ls()
@@ -302,6 +301,35 @@ wd_clean() {
     local count=0
     local wd_tmp=""
 
+    if [[ -n $WD_DIRDB ]]
+    then
+        local -a stale
+        for key in ${(k)points}
+        do
+            val=${points[$key]}
+            if [[ ! -d "${val/#\~/$HOME}" ]]
+            then
+                wd_print_msg $WD_YELLOW "Nonexistent directory: ${key} -> ${val}"
+                stale+=($key)
+            fi
+        done
+
+        if [[ $#stale -eq 0 ]]
+        then
+            wd_print_msg $WD_BLUE "No warp points to clean, carry on!"
+        elif $force || wd_yesorno "Removing ${#stale} warp points. Continue? (Y/n)"
+        then
+            for key in $stale
+            do
+                omz_dirdb_unmark wd $key
+            done
+            wd_print_msg $WD_GREEN "Cleanup complete. ${#stale} warp point(s) removed"
+        else
+            wd_print_msg $WD_BLUE "Cleanup aborted"
+        fi
+        return
+    fi
+
     while read line
     do
         if [[ $line != "" ]]
@@ -335,6 +363,7 @@ wd_clean() {
 }
 
 local WD_CONFIG=$HOME/.warprc
+local WD_DIRDB
 local WD_QUIET=0
 local WD_EXIT_CODE=0
 local WD_DEBUG=0
@@ -357,10 +386,15 @@ fi
 if [[ ! -z $wd_alt_config ]]
 then
     WD_CONFIG=$wd_alt_config[2]
+elif (( ${+functions[omz_dirdb_sync]} ))
+then
+    # warp points are marks in the shared directory database
+    # (lib/directories.zsh); ~/.warprc is imported when it is created
+    WD_DIRDB=1
 fi
 
 # check if config file exists
-if [ ! -e $WD_CONFIG ]
+if [[ -z $WD_DIRDB && ! -e $WD_CONFIG ]]
 then
     # if not, create config file
     touch $WD_CONFIG
@@ -368,15 +402,25 @@ fi
 
 # load warp points
 typeset -A points
-while read -r line
-do
-    arr=(${(s,:,)line})
-    key=${arr[1]}
-    # join the rest, in case the path contains colons
-    val=${(j,:,)arr[2,-1]}
+if [[ -n $WD_DIRDB ]]
+then
+    local -a reply
+    omz_dirdb_marks wd
+    for key val in "${(@)reply}"
+    do
+        points[$key]="${val/#$HOME/~}"
+    done
+else
+    while read -r line
+    do
+        arr=(${(s,:,)line})
+        key=${arr[1]}
+        # join the rest, in case the path contains colons
+        val=${(j,:,)arr[2,-1]}
 
-    points[$key]=$val
-done < $WD_CONFIG
+        points[$key]=$val
+    done < $WD_CONFIG
+fi
 
 # get opts
 args=$(getopt -o a:r:c:lhs -l add:,rm:,clean\!,list,ls:,path:,help,show -- $*)
@@ -387,7 +431,7 @@ then
     wd_print_usage
 
     # check if config file is writeable
-elif [ ! -w $WD_CONFIG ]
+elif [[ -z $WD_DIRDB && ! -w $WD_CONFIG ]]
 then
     # do nothing
     # can't run `exit`, as this would exit the executing shell